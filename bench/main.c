@@ -0,0 +1,166 @@
+#include "SDL_render.h"
+#define CLAY_IMPLEMENTATION
+#include <clay.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL_image.h"
+#include "SDL_stdinc.h"
+#include "SDL_timer.h"
+
+#include "clay_renderer_sdl.h"
+
+#define DEFAULT_WIDTH 1280
+#define DEFAULT_HEIGHT 720
+#define DEFAULT_FRAMES 2000
+#define FONT_HACK_24 0
+#define FONT_HACK_12 1
+#define ROWS 32
+#define FRAME_TIME 0.016f
+
+// https://rosepinetheme.com/
+Clay_Color Base = {.r = 25, .g = 23, .b = 36, .a = 255};
+Clay_Color Surface = {.r = 31, .g = 29, .b = 46, .a = 255};
+Clay_Color OverLay = {.r = 38, .g = 35, .b = 58, .a = 255};
+Clay_Color Text = {.r = 224, .g = 222, .b = 244, .a = 255};
+Clay_Color Iris = {.r = 196, .g = 167, .b = 231, .a = 255};
+
+Clay_String lorum_long = CLAY_STRING(
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+    "commodo consequat. Duis aute irure dolor in reprehenderit in voluptate "
+    "velit esse cillum dolore eu fugiat nulla pariatur. Excepteur sint "
+    "occaecat cupidatat non proident, sunt in culpa qui officia deserunt "
+    "mollit anim id est laborum.");
+Clay_String lorum_short = CLAY_STRING("Lorem ipsum dolor sit amet");
+
+// Window sizes cycled through so text wrapping and sizing get re-laid out
+Clay_Dimensions Sizes[] = {{1280, 720}, {1920, 1080}, {800, 600}, {640, 960}};
+int Sizes_Len = sizeof(Sizes) / sizeof(Clay_Dimensions);
+
+// Headless benchmark, renders a fixed number of frames and exits
+// usage: benchapp [frames]
+int main(int argc, char *argv[]) {
+  int frames = DEFAULT_FRAMES;
+  if (argc > 1)
+    frames = atoi(argv[1]);
+  if (frames <= 0) {
+    printf("usage: %s [frames]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Don't overwrite, so a real driver can still be picked from the shell
+  SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+  SDL_setenv("SDL_RENDER_DRIVER", "software", 0);
+
+  uint64_t clayMemSize = Clay_MinMemorySize();
+  Clay_Arena arena =
+      Clay_CreateArenaWithCapacityAndMemory(clayMemSize, malloc(clayMemSize));
+  Clay_SDL_Initialize(DEFAULT_WIDTH, DEFAULT_HEIGHT, "SDL Clay Bench", 0,
+                      SDL_WINDOW_HIDDEN);
+
+  Clay_Initialize(arena, (Clay_Dimensions){.width = DEFAULT_WIDTH,
+                                           .height = DEFAULT_HEIGHT});
+
+  Clay_SDL_LoadFont(FONT_HACK_24, "resources/Hack-Regular.ttf", 24);
+  Clay_SDL_LoadFont(FONT_HACK_12, "resources/Hack-Regular.ttf", 12);
+
+  IMG_Init(IMG_INIT_PNG);
+  SDL_Texture *texture = IMG_LoadTexture(renderer, "resources/SDL_logo.png");
+  if (texture == NULL) {
+    printf("Failed to load resources/SDL_logo.png\n");
+    return EXIT_FAILURE;
+  }
+
+  Clay_SDL_Clear_Color = Base;
+  uint64_t layoutTicks = 0;
+  uint64_t renderTicks = 0;
+  for (int frame = 0; frame < frames; frame++) {
+    if (frame % 100 == 0)
+      Clay_SetLayoutDimensions(Sizes[(frame / 100) % Sizes_Len]);
+    Clay_SetPointerState(
+        (Clay_Vector2){.x = frame % DEFAULT_WIDTH, .y = frame % DEFAULT_HEIGHT},
+        frame % 2);
+    Clay_UpdateScrollContainers(true, (Clay_Vector2){.y = -1}, FRAME_TIME);
+
+    uint64_t start = SDL_GetPerformanceCounter();
+    Clay_BeginLayout();
+
+    CLAY(CLAY_ID("Root"),
+         CLAY_LAYOUT({
+             .sizing = {CLAY_SIZING_GROW(), CLAY_SIZING_GROW()},
+             .padding = {16, 16},
+             .childGap = 16,
+             .layoutDirection = CLAY_LEFT_TO_RIGHT,
+         }),
+         CLAY_RECTANGLE(
+             {.color = Surface, .cornerRadius = CLAY_CORNER_RADIUS(16)})) {
+      CLAY(CLAY_ID("SideBar"),
+           CLAY_LAYOUT(
+               {.layoutDirection = CLAY_TOP_TO_BOTTOM,
+                .sizing = {CLAY_SIZING_PERCENT(0.2f), CLAY_SIZING_GROW()},
+                .childGap = 16}),
+           CLAY_RECTANGLE(
+               {.color = OverLay, .cornerRadius = CLAY_CORNER_RADIUS(16)})) {
+        CLAY(CLAY_ID("Image"),
+             CLAY_LAYOUT({.sizing = {.width = CLAY_SIZING_FIXED(179),
+                                     .height = CLAY_SIZING_FIXED(99)}}),
+             CLAY_IMAGE({.imageData = texture, {.width = 179, .height = 99}})) {
+        }
+        CLAY_TEXT(lorum_short, CLAY_TEXT_CONFIG({.fontSize = 12,
+                                                 .fontId = FONT_HACK_12,
+                                                 .textColor = Text}));
+      }
+      CLAY(CLAY_ID("MainContent"),
+           CLAY_LAYOUT({.sizing = {CLAY_SIZING_GROW(), CLAY_SIZING_GROW()},
+                        .layoutDirection = CLAY_TOP_TO_BOTTOM,
+                        .padding = {16, 16},
+                        .childGap = 16}),
+           CLAY_SCROLL({.vertical = true}),
+           CLAY_BORDER({.cornerRadius = CLAY_CORNER_RADIUS(16),
+                        .right = {.width = 4, .color = Iris},
+                        .left = {.width = 4, .color = Iris},
+                        .top = {.width = 0, .color = Iris},
+                        .bottom = {.width = 0, .color = Iris}})) {
+        for (int i = 0; i < ROWS; i++) {
+          CLAY(CLAY_IDI("Row", i),
+               CLAY_LAYOUT({.sizing = {CLAY_SIZING_GROW(), CLAY_SIZING_FIT()},
+                            .layoutDirection = CLAY_TOP_TO_BOTTOM,
+                            .padding = {8, 8}}),
+               CLAY_RECTANGLE(
+                   {.color = OverLay, .cornerRadius = CLAY_CORNER_RADIUS(8)})) {
+            CLAY_TEXT(lorum_short, CLAY_TEXT_CONFIG({.fontSize = 24,
+                                                     .fontId = FONT_HACK_24,
+                                                     .textColor = Text}));
+            CLAY_TEXT(lorum_long,
+                      CLAY_TEXT_CONFIG({.wrapMode = CLAY_TEXT_WRAP_WORDS,
+                                        .fontSize = 12,
+                                        .fontId = FONT_HACK_12,
+                                        .textColor = Text}));
+          }
+        }
+      }
+    }
+
+    Clay_RenderCommandArray renderCommands = Clay_EndLayout();
+    uint64_t layoutEnd = SDL_GetPerformanceCounter();
+    Clay_SDL_Render(renderCommands);
+    uint64_t renderEnd = SDL_GetPerformanceCounter();
+
+    layoutTicks += layoutEnd - start;
+    renderTicks += renderEnd - layoutEnd;
+  }
+
+  double frequency = SDL_GetPerformanceFrequency();
+  printf("frames: %d\n", frames);
+  printf("layout: %.3f ms/frame\n", layoutTicks * 1000.0 / frequency / frames);
+  printf("render: %.3f ms/frame\n", renderTicks * 1000.0 / frequency / frames);
+
+  SDL_DestroyTexture(texture);
+  IMG_Quit();
+  SDL_Quit();
+  return EXIT_SUCCESS;
+}
@@ -285,7 +285,7 @@ void Clay_SDL_Initialize(int width, int height, const char *title,
     printf("SDL_CreateWindow Error: %s\n", SDL_GetError());
     exit(-1);
   }
-  renderer = SDL_CreateRenderer(window, 0, SDL_RENDERER_ACCELERATED);
+  renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
   if (renderer == NULL) {
     printf("SDL_CreateRenderer Error: %s\n", SDL_GetError());
 